@@ -7,11 +7,13 @@
 
 // Inclusão das bibliotecas necessárias
 #include <stdio.h>              // Biblioteca padrão de I/O
+#include <string.h>             // memcpy, strcmp, strcpy e strlen
 #include "pico/stdlib.h"        // Biblioteca principal do Raspberry Pi Pico
 #include "hardware/gpio.h"      // Controle de GPIO
 #include "hardware/uart.h"      // Comunicação UART
 #include "hardware/i2c.h"       // Comunicação I2C
 #include "hardware/irq.h"       // Tratamento de interrupções
+#include "hardware/sync.h"      // Seção crítica da tela pendente
 #include "inc/ssd1306.h"        // Controle do display OLED
 #include "inc/font.h"           // Fonte para o display OLED
 #include "ws2812.pio.h"         // Controle dos LEDs WS2812
@@ -36,6 +38,9 @@
 #define MATRIX_WIDTH 5          // Largura da matriz
 #define MATRIX_HEIGHT 5         // Altura da matriz
 #define ENDERECO 0x3C           // Endereço I2C do display OLED
+#define SCREEN_CACHE_SIZE 4     // Telas pré-renderizadas mantidas em cache
+#define SCREEN_TEXT_MAX 50      // Tamanho máximo do texto usado como chave
+#define FRAME_SIZE (WIDTH * HEIGHT / 8) // Bytes de um quadro do display
 
 // Variáveis globais e estados
 static PIO ws2812_pio = pio0;    // Controlador PIO para WS2812
@@ -46,6 +51,23 @@ volatile bool led_blue_state = false;    // Estado do LED azul
 // Timestamps para debounce dos botões
 volatile uint32_t last_button_a_time = 0;
 volatile uint32_t last_button_b_time = 0;
+// Tela pedida pela interrupção dos botões, desenhada no loop principal
+static char pending_msg[SCREEN_TEXT_MAX];
+volatile bool display_pending = false;
+
+// Cache LRU de telas já renderizadas, indexado pelo texto exibido.
+// Dimensionado para as quatro telas de estado dos botões A e B (ON/OFF).
+typedef struct {
+    char text[SCREEN_TEXT_MAX];  // Texto que gerou a tela
+    uint8_t frame[FRAME_SIZE];   // Quadro renderizado
+    uint32_t last_used;          // Marca de uso para o critério LRU
+    bool valid;                  // Entrada preenchida
+} screen_cache_entry_t;
+
+static screen_cache_entry_t screen_cache[SCREEN_CACHE_SIZE];
+static uint32_t screen_cache_clock = 0;
+uint32_t screen_cache_hits = 0;    // Telas restauradas do cache
+uint32_t screen_cache_misses = 0;  // Telas cacheáveis renderizadas do zero
 
 // Padrões dos números na matriz 5x5
 // Cada número é representado por uma matriz 5x5 onde:
@@ -63,8 +85,9 @@ const uint8_t number_patterns[10][MATRIX_SIZE][MATRIX_SIZE] = {
     {{1,1,1,1,1}, {1,0,0,0,1}, {1,1,1,1,1}, {0,0,0,0,1}, {1,1,1,1,1}}   // Número 9
 };
 
-// Declaração antecipada da função update_display
-void update_display(ssd1306_t *display, const char *text);
+// Declarações antecipadas das funções do display
+void update_display(ssd1306_t *display, const char *text, bool use_cache);
+void print_display_stats();
 
 // Callback de interrupção para os botões
 void gpio_callback(uint gpio, uint32_t events) {
@@ -76,11 +99,10 @@ void gpio_callback(uint gpio, uint32_t events) {
             led_green_state = !led_green_state; // Inverte estado do LED
             gpio_put(LED_GREEN_PIN, led_green_state);
             
-            // Atualiza display e envia mensagem via UART
-            char msg[50];
-            sprintf(msg, "Botao A        LED Verde: %s", led_green_state ? "ON" : "OFF");
-            update_display(&display, msg);
-            printf("%s\n", msg);
+            // Agenda a atualização do display e envia mensagem via UART
+            sprintf(pending_msg, "Botao A        LED Verde: %s", led_green_state ? "ON" : "OFF");
+            display_pending = true;
+            printf("%s\n", pending_msg);
             
             last_button_a_time = current_time;
         }
@@ -90,11 +112,10 @@ void gpio_callback(uint gpio, uint32_t events) {
             led_blue_state = !led_blue_state; // Inverte estado do LED
             gpio_put(LED_BLUE_PIN, led_blue_state);
             
-            // Atualiza display e envia mensagem via UART
-            char msg[50];
-            sprintf(msg, "Botao B        LED Azul: %s", led_blue_state ? "ON" : "OFF");
-            update_display(&display, msg);
-            printf("%s\n", msg);
+            // Agenda a atualização do display e envia mensagem via UART
+            sprintf(pending_msg, "Botao B        LED Azul: %s", led_blue_state ? "ON" : "OFF");
+            display_pending = true;
+            printf("%s\n", pending_msg);
             
             last_button_b_time = current_time;
         }
@@ -159,8 +180,11 @@ void display_number(uint8_t number) {
 
 void process_uart_input() {
     if (stdio_usb_connected()) {
-        char c;
-        if (scanf("%c", &c) == 1) {
+        // Leitura sem bloqueio para que o loop principal continue
+        // atendendo as telas pendentes dos botões
+        int ch = getchar_timeout_us(0);
+        if (ch != PICO_ERROR_TIMEOUT) {
+            char c = (char)ch;
             printf("Recebido - Char: '%c' | Dec: %d | Hex: 0x%02X\n", c, (uint8_t)c, (uint8_t)c);
             
             if (c >= '0' && c <= '9') {
@@ -182,19 +206,98 @@ void process_uart_input() {
                 clear_leds();
                 printf("Matriz limpa!\n");
             }
-            
-            char mensagem[2] = { (char)c, '\0' };
-            update_display(&display, mensagem);
+
+            // Caractere '?' exibe as estatísticas do cache do display
+            // sem alterar a tela atual
+            if (c == '?') {
+                print_display_stats();
+            } else {
+                // Telas de um caractere ficam fora do cache para não expulsar
+                // as telas de estado dos botões
+                char mensagem[2] = { (char)c, '\0' };
+                update_display(&display, mensagem, false);
+            }
         }
     }
     sleep_ms(100);
 }
 
 
-void update_display(ssd1306_t *display, const char *text) {
-    ssd1306_fill(display, false);
-    ssd1306_draw_string(display, text, 10, 25);
-    ssd1306_send_data(display);
+// Renderiza o texto no display. Com use_cache, telas recorrentes são
+// restauradas do cache LRU em vez de redesenhadas caractere a caractere.
+// Deve ser chamada apenas do loop principal (ver process_pending_display).
+void update_display(ssd1306_t *display, const char *text, bool use_cache) {
+    screen_cache_entry_t *slot = NULL;
+    bool hit = false;
+
+    // O cache guarda quadros de FRAME_SIZE bytes; outro tamanho de display
+    // simplesmente não usa o cache
+    if (display->bufsize - 1 != FRAME_SIZE) {
+        use_cache = false;
+    }
+
+    // Procura a tela no cache e, em caso de falha, escolhe a entrada menos usada
+    if (use_cache && strlen(text) < SCREEN_TEXT_MAX) {
+        for (int i = 0; i < SCREEN_CACHE_SIZE; i++) {
+            screen_cache_entry_t *entry = &screen_cache[i];
+            if (entry->valid && strcmp(entry->text, text) == 0) {
+                slot = entry;
+                hit = true;
+                break;
+            }
+            if (slot == NULL || !entry->valid ||
+                (slot->valid && entry->last_used < slot->last_used)) {
+                slot = entry;
+            }
+        }
+    }
+
+    if (hit) {
+        // Tela já renderizada: restaura o quadro sem redesenhar os caracteres
+        memcpy(display->ram_buffer + 1, slot->frame, FRAME_SIZE);
+        screen_cache_hits++;
+    } else {
+        ssd1306_fill(display, false);
+        ssd1306_draw_string(display, text, 10, 25);
+
+        if (slot != NULL) {
+            strcpy(slot->text, text);
+            memcpy(slot->frame, display->ram_buffer + 1, FRAME_SIZE);
+            slot->valid = true;
+            screen_cache_misses++;
+        }
+    }
+
+    if (slot != NULL) {
+        slot->last_used = ++screen_cache_clock;
+    }
+
+    // Só envia via I2C as colunas que diferem do que o painel já exibe
+    ssd1306_send_changed(display);
+}
+
+// Desenha a tela agendada pela interrupção dos botões, se houver
+void process_pending_display() {
+    char msg[SCREEN_TEXT_MAX];
+
+    uint32_t irq_state = save_and_disable_interrupts();
+    bool pending = display_pending;
+    if (pending) {
+        strcpy(msg, pending_msg);
+        display_pending = false;
+    }
+    restore_interrupts(irq_state);
+
+    if (pending) {
+        update_display(&display, msg, true);
+    }
+}
+
+void print_display_stats() {
+    printf("Display - Cache hits: %lu | Cache misses: %lu | Envios evitados: %lu\n",
+           (unsigned long)screen_cache_hits,
+           (unsigned long)screen_cache_misses,
+           (unsigned long)display.skipped_flushes);
 }
 
 void uart_init_custom() {
@@ -234,7 +337,7 @@ void setup_display() {
     
     ssd1306_init(&display, 128, 64, false, ENDERECO, I2C_PORT);
     ssd1306_fill(&display, false);
-    update_display(&display, "Sistema Pronto!");
+    update_display(&display, "Sistema Pronto!", false);
 }
 
 int main() {
@@ -253,6 +356,7 @@ int main() {
     
     // Loop principal
     while(true) {
+        process_pending_display();  // Atualiza o display pedido pelos botões
         process_uart_input();  // Processa a entrada UART
         sleep_ms(10);
     }
@@ -1,3 +1,4 @@
+#include <string.h>
 #include "ssd1306.h"
 #include "font.h"
 
@@ -12,6 +13,9 @@ void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_v
   ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
   ssd->ram_buffer[0] = 0x40;
   ssd->port_buffer[0] = 0x80;
+  ssd->shown_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
+  ssd->shown_hash = 0;
+  ssd->skipped_flushes = 0;
   
   
   ssd1306_config(ssd);
@@ -43,6 +47,9 @@ void ssd1306_config(ssd1306_t *ssd) {
   ssd1306_command(ssd, SET_CHARGE_PUMP);
   ssd1306_command(ssd, 0x14);
   ssd1306_command(ssd, SET_DISP | 0x01);
+
+  // Após configurar, o conteúdo do painel é desconhecido
+  ssd1306_invalidate(ssd);
 }
 
 void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
@@ -56,6 +63,16 @@ void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
   );
 }
 
+// Hash FNV-1a de 32 bits do quadro (ignora o byte de controle 0x40)
+static uint32_t ssd1306_frame_hash(const ssd1306_t *ssd) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 1; i < ssd->bufsize; ++i) {
+    hash ^= ssd->ram_buffer[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
 void ssd1306_send_data(ssd1306_t *ssd) {
   ssd1306_command(ssd, SET_COL_ADDR);
   ssd1306_command(ssd, 0);
@@ -70,6 +87,74 @@ void ssd1306_send_data(ssd1306_t *ssd) {
     ssd->bufsize,
     false
   );
+
+  memcpy(ssd->shown_buffer, ssd->ram_buffer, ssd->bufsize);
+  ssd->shown_hash = ssd1306_frame_hash(ssd);
+  ssd->shown_valid = true;
+}
+
+// Força o próximo ssd1306_send_changed a enviar o quadro completo
+void ssd1306_invalidate(ssd1306_t *ssd) {
+  ssd->shown_valid = false;
+}
+
+// Envia apenas as colunas que mudaram desde o último envio.
+// Se o quadro for igual ao exibido, nada é enviado via I2C; o hash serve
+// de teste rápido e o memcmp confirma antes de pular o envio.
+void ssd1306_send_changed(ssd1306_t *ssd) {
+  if (!ssd->shown_valid) {
+    ssd1306_send_data(ssd);
+    return;
+  }
+
+  uint32_t hash = ssd1306_frame_hash(ssd);
+  if (hash == ssd->shown_hash &&
+      memcmp(ssd->ram_buffer + 1, ssd->shown_buffer + 1, ssd->bufsize - 1) == 0) {
+    ssd->skipped_flushes++;
+    return;
+  }
+
+  // No modo de endereçamento vertical cada coluna ocupa 'pages' bytes
+  // consecutivos, então um intervalo de colunas é contíguo no buffer
+  uint8_t first = 0, last = ssd->width - 1;
+  while (first < last &&
+         memcmp(ssd->ram_buffer + 1 + first * ssd->pages,
+                ssd->shown_buffer + 1 + first * ssd->pages, ssd->pages) == 0)
+    ++first;
+  while (last > first &&
+         memcmp(ssd->ram_buffer + 1 + last * ssd->pages,
+                ssd->shown_buffer + 1 + last * ssd->pages, ssd->pages) == 0)
+    --last;
+
+  ssd1306_command(ssd, SET_COL_ADDR);
+  ssd1306_command(ssd, first);
+  ssd1306_command(ssd, last);
+  ssd1306_command(ssd, SET_PAGE_ADDR);
+  ssd1306_command(ssd, 0);
+  ssd1306_command(ssd, ssd->pages - 1);
+
+  // Envia o intervalo em blocos, cada um com seu byte de controle 0x40;
+  // o ponteiro da GDDRAM avança sozinho dentro da janela configurada
+  uint8_t chunk[SSD1306_CHUNK_BYTES + 1];
+  chunk[0] = 0x40;
+  size_t start = 1 + first * ssd->pages;
+  size_t end = 1 + (last + 1) * ssd->pages;
+  for (size_t pos = start; pos < end; pos += sizeof(chunk) - 1) {
+    size_t len = end - pos;
+    if (len > sizeof(chunk) - 1)
+      len = sizeof(chunk) - 1;
+    memcpy(chunk + 1, ssd->ram_buffer + pos, len);
+    i2c_write_blocking(
+      ssd->i2c_port,
+      ssd->address,
+      chunk,
+      len + 1,
+      false
+    );
+  }
+
+  memcpy(ssd->shown_buffer + start, ssd->ram_buffer + start, end - start);
+  ssd->shown_hash = hash;
 }
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
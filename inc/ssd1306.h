@@ -4,6 +4,7 @@
 
 #define WIDTH 128
 #define HEIGHT 64
+#define SSD1306_CHUNK_BYTES 64  // Bytes de dados por transação no envio parcial
 
 typedef enum {
   SET_CONTRAST = 0x81,
@@ -32,12 +33,18 @@ typedef struct {
   uint8_t *ram_buffer;
   size_t bufsize;
   uint8_t port_buffer[2];
+  uint8_t *shown_buffer;      // Cópia do quadro que o painel está exibindo
+  uint32_t shown_hash;        // Hash do quadro exibido no painel
+  bool shown_valid;           // Indica se shown_buffer reflete o painel
+  uint32_t skipped_flushes;   // Envios evitados por quadro idêntico
 } ssd1306_t;
 
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
 void ssd1306_config(ssd1306_t *ssd);
 void ssd1306_command(ssd1306_t *ssd, uint8_t command);
 void ssd1306_send_data(ssd1306_t *ssd);
+void ssd1306_invalidate(ssd1306_t *ssd);
+void ssd1306_send_changed(ssd1306_t *ssd);
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
 void ssd1306_fill(ssd1306_t *ssd, bool value);